@@ -2,3 +2,15 @@
 if exist origotoc.exe del origotoc.exe
 if exist origotoc.c del origotoc.c
 if exist origotoc.h del origotoc.h
+if exist *.peg.txt del *.peg.txt
+if exist *.fast.txt del *.fast.txt
+if exist *.peg.rtc del *.peg.rtc
+if exist *.peg.rth del *.peg.rth
+if exist *.folded del *.folded
+if exist *.rtj del *.rtj
+if exist *.rtd del *.rtd
+if exist *.rtp del *.rtp
+if exist *.rtq del *.rtq
+if exist *.check.c del *.check.c
+if exist *.check.o del *.check.o
+if exist *.check.exe del *.check.exe
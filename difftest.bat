@@ -0,0 +1,20 @@
+@echo off
+rem Checks the fast parser against the packcc grammar on every .ret file
+if not exist origotoc.exe goto :eof
+
+for %%f in (*.ret) do call :compare %%~nf
+goto :eof
+
+:compare
+echo Comparing %1.ret...
+if exist %1.rtj del %1.rtj
+origotoc --peg --dump=ast %1.ret > %1.peg.txt
+if exist %1.rtc move /y %1.rtc %1.peg.rtc > nul
+if exist %1.rth move /y %1.rth %1.peg.rth > nul
+if exist %1.rtj move /y %1.rtj %1.peg.rtj > nul
+origotoc --dump=ast %1.ret > %1.fast.txt
+fc %1.peg.txt %1.fast.txt > nul || echo   Output differs: fc %1.peg.txt %1.fast.txt
+if exist %1.rtj fc %1.peg.rtj %1.rtj > nul || echo   Tree differs: fc %1.peg.rtj %1.rtj
+if exist %1.rtc fc %1.peg.rtc %1.rtc > nul || echo   C source differs: fc %1.peg.rtc %1.rtc
+if exist %1.rth fc %1.peg.rth %1.rth > nul || echo   C header differs: fc %1.peg.rth %1.rth
+goto :eof
@@ -1123,9 +1123,6 @@ int ParseEnum( RetFile* fromSource, CFile* toCgen, SymTable* usingSymTable ) {
   if( fromSource == NULL ) { return 1; }
   if( toCgen == NULL ) { return 2; }
   if( usingSymTable == NULL ) { return 3; }
-
-  printf( "ParseEnum\n" );
-
   return 4;
 }
 
@@ -1201,7 +1198,6 @@ void ParseLocalVar( RetFile* fromSource, CFile* toCgen,
     ParseTypeSpec( fromSource, usingSymTable, &varType );
 
     do {
-putchar( '.' );
       SkipNonterminals( fromSource );
       memset( ident, 0, sizeof(ident) );
       result = ReadIdent(fromSource, ident);
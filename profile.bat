@@ -0,0 +1,10 @@
+@echo off
+call clean.bat
+
+echo Generating OrigoToC parser from grammar...
+.\tools\packcc\packcc origotoc.peg
+
+if exist origotoc.c if exist origotoc.h echo Building OrigoToC rule profiler...
+if exist origotoc.c if exist origotoc.h tools\tcc\tcc -DORIGOTOC_PROFILE origotoc.c
+
+if exist origotoc.exe if exist test.ret origotoc test.ret
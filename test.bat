@@ -1,2 +1,19 @@
 @echo off
 if exist origotoc.exe if exist test.ret origotoc test.ret
+
+rem Inherited members are reached through their bases' paths, which must
+rem compile against the generated header
+if not exist origotoc.exe goto :eof
+if not exist member.ret goto :binds
+origotoc member.ret > nul || goto :binds
+echo #include "member.rtc"> member.check.c
+tools\tcc\tcc -c member.check.c -o member.check.o && echo Member paths compile.
+
+:binds
+rem Lowered binds and their method tables must link, so the bind test
+rem program is built as is
+if not exist origotoc.exe goto :eof
+if not exist bind.ret goto :eof
+origotoc bind.ret > nul || goto :eof
+echo #include "bind.rtc"> bind.check.c
+tools\tcc\tcc bind.check.c -o bind.check.exe && echo Lowered binds link.